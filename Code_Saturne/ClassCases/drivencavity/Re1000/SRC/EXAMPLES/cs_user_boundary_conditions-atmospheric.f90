@@ -129,10 +129,14 @@ integer          ilelt, nlelt
 double precision d2s3
 double precision zref, xuref
 double precision ustar, rugd, rugt
-double precision zent, xuent, xvent
-double precision xkent, xeent
+double precision zent, xvent
+double precision xkent
+double precision ustk, ust3k
 
 integer, allocatable, dimension(:) :: lstelt
+
+double precision, save :: rugcac = -1.d0
+double precision, allocatable, dimension(:), save :: flncac, finvcac
 !< [loc_var_dec]
 
 !===============================================================================
@@ -226,6 +230,38 @@ call getfbr('31',nlelt,lstelt)
 !   - Zone number (from 1 to n)
 izone = 3
 
+! - The shape of the log law only depends on the face heights and on the
+!   roughness: it is computed once (or at each call if the mesh moves,
+!   with ALE), and only rescaled by the friction velocity, which follows
+!   the reference velocity xuref at zref.
+
+if (.not.allocated(flncac)) then
+  allocate(flncac(nlelt), finvcac(nlelt))
+  rugcac = -1.d0
+else if (size(flncac).ne.nlelt) then
+  deallocate(flncac, finvcac)
+  allocate(flncac(nlelt), finvcac(nlelt))
+  rugcac = -1.d0
+endif
+
+if (rugd.ne.rugcac .or. iale.ge.1) then
+  do ilelt = 1, nlelt
+    ifac = lstelt(ilelt)
+    zent = cdgfbo(3,ifac)
+    flncac(ilelt) = log((zent+rugd)/rugd)
+    finvcac(ilelt) = 1.d0/(zent+rugd)
+  enddo
+  rugcac = rugd
+endif
+
+! - Dynamical variables are prescribed with a rough log law
+
+ustar = xkappa*xuref/log((zref+rugd)/rugd)
+ustk  = ustar/xkappa
+ust3k = ustar**3/xkappa
+xvent = 0.d0
+xkent = ustar**2/sqrt(cmu)
+
 do ilelt = 1, nlelt
 
   ifac = lstelt(ilelt)
@@ -236,56 +272,63 @@ do ilelt = 1, nlelt
   ! - Boundary conditions are prescribed from the meteo profile
   iprofm(izone) = 1
 
-  ! - Dynamical variables are prescribed with a rough log law
-  zent=cdgfbo(3,ifac)
-
-  ustar=xkappa*xuref/log((zref+rugd)/rugd)
-  xuent=ustar/xkappa*log((zent+rugd)/rugd)
-  xvent = 0.d0
-  xkent=ustar**2/sqrt(cmu)
-  xeent=ustar**3/xkappa/(zent+rugd)
-
   itypfb(ifac) = ientre
 
-  rcodcl(ifac,iu,1) = xuent
+  rcodcl(ifac,iu,1) = ustk*flncac(ilelt)
   rcodcl(ifac,iv,1) = xvent
   rcodcl(ifac,iw,1) = 0.d0
 
-  ! itytur is a flag equal to iturb/10
-  if    (itytur.eq.2) then
+enddo
+
+! itytur is a flag equal to iturb/10
+if    (itytur.eq.2) then
 
+  do ilelt = 1, nlelt
+    ifac = lstelt(ilelt)
     rcodcl(ifac,ik,1)  = xkent
-    rcodcl(ifac,iep,1) = xeent
+    rcodcl(ifac,iep,1) = ust3k*finvcac(ilelt)
+  enddo
 
-  elseif(itytur.eq.3) then
+elseif(itytur.eq.3) then
 
+  do ilelt = 1, nlelt
+    ifac = lstelt(ilelt)
     rcodcl(ifac,ir11,1) = d2s3*xkent
     rcodcl(ifac,ir22,1) = d2s3*xkent
     rcodcl(ifac,ir33,1) = d2s3*xkent
     rcodcl(ifac,ir12,1) = 0.d0
     rcodcl(ifac,ir13,1) = 0.d0
     rcodcl(ifac,ir23,1) = 0.d0
-    rcodcl(ifac,iep,1)  = xeent
+    rcodcl(ifac,iep,1)  = ust3k*finvcac(ilelt)
+  enddo
 
-  elseif(iturb.eq.50) then
+elseif(iturb.eq.50) then
 
+  do ilelt = 1, nlelt
+    ifac = lstelt(ilelt)
     rcodcl(ifac,ik,1)   = xkent
-    rcodcl(ifac,iep,1)  = xeent
+    rcodcl(ifac,iep,1)  = ust3k*finvcac(ilelt)
     rcodcl(ifac,iphi,1) = d2s3
     rcodcl(ifac,ifb,1)  = 0.d0
+  enddo
 
-  elseif(iturb.eq.60) then
+elseif(iturb.eq.60) then
 
+  do ilelt = 1, nlelt
+    ifac = lstelt(ilelt)
     rcodcl(ifac,ik,1)   = xkent
-    rcodcl(ifac,iomg,1) = xeent/cmu/xkent
+    rcodcl(ifac,iomg,1) = ust3k*finvcac(ilelt)/cmu/xkent
+  enddo
 
-  elseif(iturb.eq.70) then
+elseif(iturb.eq.70) then
 
-    rcodcl(ifac,inusa,1) = cmu*xkent**2/xeent
+  do ilelt = 1, nlelt
+    ifac = lstelt(ilelt)
+    rcodcl(ifac,inusa,1) = cmu*xkent**2/(ust3k*finvcac(ilelt))
+  enddo
 
-  endif
+endif
 
-enddo
 !< [example_3]
 
 ! --- Prescribe at boundary faces of color '12' an outlet for all phases
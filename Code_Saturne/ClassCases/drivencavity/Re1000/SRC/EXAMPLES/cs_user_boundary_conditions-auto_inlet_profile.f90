@@ -130,12 +130,18 @@ double precision rcodcl(nfabor,nvarcl,3)
 
 !< [loc_var_dec]
 integer          ifac, iel, ii, ilelt, nlelt
+integer          iwall, nwall, nwallg
 
 double precision xustar2, xdh, d2s3, rhomoy
 double precision acc(2), fmprsc, fmul, uref2, vnrm
+double precision d1s7, dmax, xprof, dist
 
 integer, allocatable, dimension(:) :: lstelt, mrkcel
 
+double precision, allocatable, dimension(:) :: dwall
+double precision, allocatable, dimension(:) :: xw, yw, zw, hw
+double precision, allocatable, dimension(:) :: xwg, ywg, zwg, hwg
+
 double precision, dimension(:), pointer :: bfpro_rom
 double precision, dimension(:), pointer :: cvar_r11, cvar_r22, cvar_r33
 double precision, dimension(:), pointer :: cvar_r12, cvar_r23, cvar_r13
@@ -225,12 +231,22 @@ if (ntcabs.eq.1) then
 
   ! For the Rij-EBRSM model (and possibly V2f), we need a non-flat profile,
   ! so as to ensure turbulent production, and avoid laminarization;
-  ! here, we simply divide the initial velocity by 10 for inlet
-  ! faces adjacent to the wall.
+  ! here, we start from a developed turbulent profile (1/7 power law of
+  ! the distance to the wall, scaled so that its mean is fmprsc), which
+  ! the feedback loop below then only has to refine. Other models start
+  ! from a flat profile.
+
+  ! The wall distance field is not yet available at the first call, so
+  ! the distance to the wall is estimated on the inlet itself, from the
+  ! inlet faces whose cell is adjacent to a wall, their own distance to
+  ! the wall being taken as half their size (a coarse estimate, only
+  ! meant to provide a starting profile).
 
   ! The loop below assumes wall conditions have been defined first
   ! (in the GUI, or in this file, before the current test).
 
+  nwall = 0
+
   if (iturb.eq.32 .or. itytur.eq.5) then
 
     allocate(mrkcel(ncelet))
@@ -245,8 +261,99 @@ if (ntcabs.eq.1) then
       endif
     enddo
 
+    do ilelt = 1, nlelt
+      ifac = lstelt(ilelt)
+      if (mrkcel(ifabor(ifac)) .eq. 1) nwall = nwall + 1
+    enddo
+
   endif
 
+  nwallg = nwall
+  if (irangp.ge.0) then
+    call parcpt(nwallg)
+  endif
+
+  dmax = 0.d0
+  fmul = fmprsc
+  d1s7 = 1.d0/7.d0
+
+  allocate(dwall(nlelt))
+
+  if (nwallg.gt.0) then
+
+    ! Gather the wall-adjacent inlet faces of all ranks
+
+    allocate(xw(nwall), yw(nwall), zw(nwall), hw(nwall))
+    allocate(xwg(nwallg), ywg(nwallg), zwg(nwallg), hwg(nwallg))
+
+    iwall = 0
+    do ilelt = 1, nlelt
+      ifac = lstelt(ilelt)
+      if (mrkcel(ifabor(ifac)) .eq. 1) then
+        iwall = iwall + 1
+        xw(iwall) = cdgfbo(1,ifac)
+        yw(iwall) = cdgfbo(2,ifac)
+        zw(iwall) = cdgfbo(3,ifac)
+        hw(iwall) = 0.5d0*sqrt(surfbn(ifac))
+      endif
+    enddo
+
+    if (irangp.ge.0) then
+      call paragv(nwall, nwallg, xw, xwg)
+      call paragv(nwall, nwallg, yw, ywg)
+      call paragv(nwall, nwallg, zw, zwg)
+      call paragv(nwall, nwallg, hw, hwg)
+    else
+      do iwall = 1, nwall
+        xwg(iwall) = xw(iwall)
+        ywg(iwall) = yw(iwall)
+        zwg(iwall) = zw(iwall)
+        hwg(iwall) = hw(iwall)
+      enddo
+    endif
+
+    ! Distance to the wall of each inlet face
+
+    do ilelt = 1, nlelt
+      ifac = lstelt(ilelt)
+      dwall(ilelt) = grand
+      do iwall = 1, nwallg
+        dist = sqrt( (cdgfbo(1,ifac)-xwg(iwall))**2                &
+                   + (cdgfbo(2,ifac)-ywg(iwall))**2                &
+                   + (cdgfbo(3,ifac)-zwg(iwall))**2) + hwg(iwall)
+        dwall(ilelt) = min(dwall(ilelt), dist)
+      enddo
+      dmax = max(dmax, dwall(ilelt))
+    enddo
+    if (irangp.ge.0) then
+      call parmax(dmax)
+    endif
+
+    deallocate(xw, yw, zw, hw)
+    deallocate(xwg, ywg, zwg, hwg)
+
+    ! Scaling so that the mean velocity is fmprsc
+
+    acc(1) = 0.d0
+    acc(2) = 0.d0
+    do ilelt = 1, nlelt
+      ifac = lstelt(ilelt)
+      xprof = (dwall(ilelt)/dmax)**d1s7
+      acc(1) = acc(1) + xprof*surfbn(ifac)
+      acc(2) = acc(2) + surfbn(ifac)
+    enddo
+    if (irangp.ge.0) then
+      call parrsm(2, acc)
+    endif
+
+    fmul = fmprsc*acc(2)/acc(1)
+
+  endif
+
+  if (allocated(mrkcel)) deallocate(mrkcel)
+
+  ! Without any wall adjacent to the inlet, the profile remains flat
+
   do ilelt = 1, nlelt
 
     ifac = lstelt(ilelt)
@@ -254,16 +361,16 @@ if (ntcabs.eq.1) then
 
     itypfb(ifac) = ientre
 
-    rcodcl(ifac,iu,1) = - fmprsc * surfbo(1,ifac) / surfbn(ifac)
-    rcodcl(ifac,iv,1) = - fmprsc * surfbo(2,ifac) / surfbn(ifac)
-    rcodcl(ifac,iw,1) = - fmprsc * surfbo(3,ifac) / surfbn(ifac)
-
-    if (iturb.eq.32 .or. itytur.eq.5) then
-      if (mrkcel(iel) .eq. 1) then
-        rcodcl(ifac,iu,1) = fmprsc/10.d0
-      endif
+    if (nwallg.gt.0) then
+      vnrm = fmul * (dwall(ilelt)/dmax)**d1s7
+    else
+      vnrm = fmprsc
     endif
 
+    rcodcl(ifac,iu,1) = - vnrm * surfbo(1,ifac) / surfbn(ifac)
+    rcodcl(ifac,iv,1) = - vnrm * surfbo(2,ifac) / surfbn(ifac)
+    rcodcl(ifac,iw,1) = - vnrm * surfbo(3,ifac) / surfbn(ifac)
+
     uref2 = rcodcl(ifac,iu,1)**2  &
           + rcodcl(ifac,iv,1)**2  &
           + rcodcl(ifac,iw,1)**2
@@ -305,9 +412,7 @@ if (ntcabs.eq.1) then
 
   enddo
 
-  if (iturb.eq.32 .or. itytur.eq.5) then
-    deallocate(mrkcel)
-  endif
+  deallocate(dwall)
 
 else
 
@@ -398,7 +503,7 @@ else
     if (nscal.gt.0) then
       do ii = 1, nscal
         call field_get_val_s(ivarfl(isca(ii)), cvar_scal)
-        rcodcl(ifac,isca(ii),1) = cvar_scal(ii)
+        rcodcl(ifac,isca(ii),1) = cvar_scal(iel)
       enddo
     endif
 
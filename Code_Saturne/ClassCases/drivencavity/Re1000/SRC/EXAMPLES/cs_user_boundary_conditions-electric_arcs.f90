@@ -508,49 +508,55 @@ do ilelt = 1, nlelt
   !    Zero flux by default
   !    Nothing to do
 
-  ! Specific model for Electric arc :
-  ! ================================
-
-  ! Vector potential  A (Ax, Ay, Az)
-
-  ! Zero flux by default because we don't a lot about vector potential
-  ! (what we know, is that A is equal to zero at the infinite)
-
-  ! All the boundary conditions for A are zero flux, except on some chosen faces
-  ! where we need to impose a value in order to have a stable calculation
-  ! These faces are chosen where we are sure that the electrical current density
-  ! remains very low generally far from the center of the electric arc and from
-  ! the electrodes:
-
-  ! On the following example, we choose to impose a "dirichlet" value for the
-  ! 3 components of A on a small zone of the boundary located near the vertical
-  ! free outlet of the computation domain.
-
-  ! In this example, the electric arc is at the center of the computational domain,
-  ! located on z axis (near x = 0 and y = 0).
-  ! The x (1st) and y (the 3rd) coordinates are contained between
-  ! -2.5 cm nd 2.5 cm:
-
-  !    Ax(t, x,y,z) = Ax(t-dt, x=2.5cm, y=2.5cm, z)
-  !    Ay(t, x,y,z) = Ay(t-dt, x=2.5cm, y=2.5cm, z)
-  !    Az(t, x,y,z) = Az(t-dt, x=2.5cm, y=2.5cm, z)
+enddo
 
-  if (ippmod(ielarc).ge.2) then
-    if (cdgfbo(1,ifac) .le.  2.249d-2  .or.                      &
-        cdgfbo(1,ifac) .ge.  2.249d-2  .or.                      &
-        cdgfbo(3,ifac) .le. -2.249d-2  .or.                      &
-        cdgfbo(3,ifac) .ge.  2.249d-2      ) then
-      iel = ifabor(ifac)
-      do idim = 1, ndimve
-        ii = ipotva(idim)
-        call field_get_val_prev_s(ivarfl(isca(ii)), cvara_potva)
+! Specific model for Electric arc :
+! ================================
+
+! Vector potential  A (Ax, Ay, Az)
+
+! Zero flux by default because we don't a lot about vector potential
+! (what we know, is that A is equal to zero at the infinite)
+
+! All the boundary conditions for A are zero flux, except on some chosen faces
+! where we need to impose a value in order to have a stable calculation
+! These faces are chosen where we are sure that the electrical current density
+! remains very low generally far from the center of the electric arc and from
+! the electrodes:
+
+! On the following example, we choose to impose a "dirichlet" value for the
+! 3 components of A on a small zone of the boundary located near the vertical
+! free outlet of the computation domain.
+
+! In this example, the electric arc is at the center of the computational domain,
+! located on z axis (near x = 0 and y = 0).
+! The x (1st) and y (the 3rd) coordinates are contained between
+! -2.5 cm nd 2.5 cm:
+
+!    Ax(t, x,y,z) = Ax(t-dt, x=2.5cm, y=2.5cm, z)
+!    Ay(t, x,y,z) = Ay(t-dt, x=2.5cm, y=2.5cm, z)
+!    Az(t, x,y,z) = Az(t-dt, x=2.5cm, y=2.5cm, z)
+
+! The loop on components is outside of the loop on faces, so that the
+! previous values of each component are mapped only once.
+
+if (ippmod(ielarc).ge.2) then
+  do idim = 1, ndimve
+    ii = ipotva(idim)
+    call field_get_val_prev_s(ivarfl(isca(ii)), cvara_potva)
+    do ilelt = 1, nlelt
+      ifac = lstelt(ilelt)
+      if (cdgfbo(1,ifac) .le.  2.249d-2  .or.                      &
+          cdgfbo(1,ifac) .ge.  2.249d-2  .or.                      &
+          cdgfbo(3,ifac) .le. -2.249d-2  .or.                      &
+          cdgfbo(3,ifac) .ge.  2.249d-2      ) then
+        iel = ifabor(ifac)
         icodcl(ifac,isca(ii))   = 1
         rcodcl(ifac,isca(ii),1) = cvara_potva(iel)
-      enddo
-    endif
-  endif
-
-enddo
+      endif
+    enddo
+  enddo
+endif
 !< [example_4]
 
 ! --- For boundary faces of color 51 assign a wall
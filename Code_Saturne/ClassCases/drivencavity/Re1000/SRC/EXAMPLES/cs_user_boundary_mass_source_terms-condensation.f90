@@ -183,12 +183,12 @@ double precision tpar
 
 integer          ieltcd
 integer          ifac, iel, iesp, iscal
-integer          ivarh
+integer          ivar, ivarh
 integer          ilelt, nlelt
 integer          izone
 integer          f_id
 
-double precision hvap, tk
+double precision hvap
 
 type(gas_mix_species_prop) s_h2o_g
 
@@ -389,60 +389,62 @@ elseif (iappel.eq.3) then
   ! To fill the spcond(nfbpcd,ivar) array
   ! if we want to specify a variable value
   !---------------------------------------
-  do ieltcd = 1, nfbpcd
 
-    ifac = ifbpcd(ieltcd)
-    iel  = ifabor(ifac)
+  ! any condensation source term
+  ! associated to each velocity component
+  ! momentum equation in this case.
+  !----------------------------------------
+  itypcd(1:nfbpcd,iu) = 0
+  spcond(1:nfbpcd,iu) = 0.d0
+  itypcd(1:nfbpcd,iv) = 0
+  spcond(1:nfbpcd,iv) = 0.d0
+  itypcd(1:nfbpcd,iw) = 0
+  spcond(1:nfbpcd,iw) = 0.d0
+
+  ! any condensation source term
+  ! associated to each turbulent variables
+  ! for (k -eps) standrad turbulence model
+  !----------------------------------------
+  if (itytur.eq.2) then
+    itypcd(1:nfbpcd,ik ) = 0
+    spcond(1:nfbpcd,ik ) = 0.d0
+    itypcd(1:nfbpcd,iep) = 0
+    spcond(1:nfbpcd,iep) = 0.d0
+  endif
 
-    ! Compute the enthalpy value of vapor gas
-    if (ntcabs.le.1) then
-      tk = t0
-    else
-      tk = cvar_h(iel)/cpro_cp(iel)
-    endif
-    hvap = s_h2o_g%cp*tk
-
-    ! any condensation source term
-    ! associated to each velocity component
-    ! momentum equation in this case.
-    !----------------------------------------
-    itypcd(ieltcd,iu) = 0
-    spcond(ieltcd,iu) = 0.d0
-    itypcd(ieltcd,iv) = 0
-    spcond(ieltcd,iv) = 0.d0
-    itypcd(ieltcd,iw) = 0
-    spcond(ieltcd,iw) = 0.d0
-
-    ! any condensation source term
-    ! associated to each turbulent variables
-    ! for (k -eps) standrad turbulence model
-    !----------------------------------------
-    if (itytur.eq.2) then
-      itypcd(ieltcd,ik ) = 0
-      spcond(ieltcd,ik ) = 0.d0
-      itypcd(ieltcd,iep) = 0
-      spcond(ieltcd,iep) = 0.d0
-    endif
-    if (nscal.gt.0) then
-      do iscal = 1, nscal
-        if (iscal.eq.iscalt) then
-
-          ! enthalpy value used for
-          ! the explicit condensation term
-          itypcd(ieltcd,isca(iscalt)) = 1
-          spcond(ieltcd,isca(iscalt)) = hvap
+  if (nscal.gt.0) then
+    do iscal = 1, nscal
+      ivar = isca(iscal)
+      if (iscal.eq.iscalt) then
+
+        ! enthalpy value of the vapor gas used for
+        ! the explicit condensation term
+        if (ntcabs.le.1) then
+          hvap = s_h2o_g%cp*t0
+          do ieltcd = 1, nfbpcd
+            itypcd(ieltcd,ivar) = 1
+            spcond(ieltcd,ivar) = hvap
+          enddo
         else
-
-          ! scalar values used for
-          ! the explicit condensation term
-          itypcd(ieltcd,isca(iscal)) = 1
-          spcond(ieltcd,isca(iscal)) = 0.d0
+          do ieltcd = 1, nfbpcd
+            iel = ifabor(ifbpcd(ieltcd))
+            itypcd(ieltcd,ivar) = 1
+            spcond(ieltcd,ivar) = s_h2o_g%cp*cvar_h(iel)/cpro_cp(iel)
+          enddo
         endif
-      enddo
-    endif
 
+      else
 
-  enddo
+        ! scalar values used for
+        ! the explicit condensation term
+        do ieltcd = 1, nfbpcd
+          itypcd(ieltcd,ivar) = 1
+          spcond(ieltcd,ivar) = 0.d0
+        enddo
+
+      endif
+    enddo
+  endif
 
 endif
 
@@ -182,14 +182,14 @@ double precision tpar
 
 ! Local variables
 
-integer          ieltcd, ii, iz
+integer          ieltcd, iz
 integer          ifac, iel, iesp, iscal
-integer          ivarh
+integer          ivar, ivarh
 integer          ilelt, nlelt
 integer          izone
 integer          f_id
 
-double precision hvap, tk
+double precision hvap
 
 type(gas_mix_species_prop) s_h2o_g
 
@@ -291,8 +291,11 @@ endif
 !===============================================================================
 if (iappel.eq.2) then
 
-  do ii = 1, nfbpcd
-    iz = izzftcd(ii)
+  ! The parameters are defined per zone (not per face), so they are set
+  ! identically on all ranks, including those without faces in a given
+  ! zone, and no parallel reduction is needed to make them consistent.
+
+  do iz = 1, nzones
     if (iz.eq.1.and.icond.eq.0) then
       ! Turbulent law and empiric correlations used to
       ! define the exchange coefficients of the sink
@@ -370,17 +373,6 @@ if (iappel.eq.2) then
 
   enddo
 
-  if (irangp.ge.0) then
-    call parimx(nzones, izcophc)
-    call parimx(nzones, izcophg)
-    call parimx(nzones, iztag1d)
-    call parrmx(nzones, ztheta)
-    call parrmx(nzones, zdxmin)
-    call parimx(nzones, znmur )
-    call parrmx(nzones, zepais)
-    call parrmx(nzones, ztpar0)
-  endif
-
 elseif (iappel.eq.3) then
 
 !===============================================================================
@@ -399,13 +391,8 @@ elseif (iappel.eq.3) then
   ivarh = isca(iscalt)
   call field_get_val_s(ivarfl(ivarh), cvar_h)
 
-  do ii = 1, nfbpcd
-
-    ifac = ifbpcd(ii)
-    iel  = ifabor(ifac)
-
-    iz = izzftcd(ii)
-
+  ! Zone parameters of the 1-D thermal model (the same on all ranks)
+  do iz = 1, nzones
     if (icond.eq.0) then
       if (iztag1d(iz).eq.1) then
         !-------------------------------------------
@@ -426,88 +413,67 @@ elseif (iappel.eq.3) then
         ! with a value specified by the user
         ztpar(iz) = 26.57d0
       endif
-    elseif (iz.eq.2.and.icond.eq.0) then
-      if (iztag1d(iz).eq.1) then
-        !-------------------------------------------
-        !Boundary conditions of the 1-D thermal model
-        !-------------------------------------------
-        zhext(iz) =  1.d+8 ; ztext(iz) = 26.57d0
-        ! --------------------------------------------
-        ! Physical properties of the concrete material
-        ! --------------------------------------------
-        ! (rob) density (kg.m-3)
-        zrob(iz)   = 8000.d0
-        ! (condb) thermal conductivity (W.m-1.C-1)
-        zcondb(iz) = 12.8d0
-        ! (cpb)   Specific heat (J.kg-1.C-1)
-        zcpb(iz) = 500.0d0
-      else
-        ! Wall temperature imposed as constant
-        ! with a value specified by the user
-        ztpar(iz) = 26.57d0
-      endif
     endif
+  enddo
 
-    ! To fill the spcond(nfbpcd,ivar) array
-    ! if we want to specify a variable value
-    !---------------------------------------
+  ! To fill the spcond(nfbpcd,ivar) array
+  ! if we want to specify a variable value
+  !---------------------------------------
+
+  ! any condensation source term
+  ! associated to each velocity component
+  ! momentum equation in this case.
+  !----------------------------------------
+  itypcd(1:nfbpcd,iu) = 0
+  spcond(1:nfbpcd,iu) = 0.d0
+  itypcd(1:nfbpcd,iv) = 0
+  spcond(1:nfbpcd,iv) = 0.d0
+  itypcd(1:nfbpcd,iw) = 0
+  spcond(1:nfbpcd,iw) = 0.d0
+
+  ! any condensation source term
+  ! associated to each turbulent variables
+  ! for (k -eps) standrad turbulence model
+  !----------------------------------------
+  if (itytur.eq.2) then
+    itypcd(1:nfbpcd,ik ) = 0
+    spcond(1:nfbpcd,ik ) = 0.d0
+    itypcd(1:nfbpcd,iep) = 0
+    spcond(1:nfbpcd,iep) = 0.d0
+  endif
 
-    ! Compute the enthalpy value of vapor gas
-    if (ntcabs.le.1) then
-      tk = t0
-    else
-      tk = cvar_h(iel)/cpro_cp(iel)
-    endif
-    hvap = s_h2o_g%cp*tk
-
-    ! any condensation source term
-    ! associated to each velocity component
-    ! momentum equation in this case.
-    !----------------------------------------
-    itypcd(ii,iu) = 0
-    spcond(ii,iu) = 0.d0
-    itypcd(ii,iv) = 0
-    spcond(ii,iv) = 0.d0
-    itypcd(ii,iw) = 0
-    spcond(ii,iw) = 0.d0
-
-    ! any condensation source term
-    ! associated to each turbulent variables
-    ! for (k -eps) standrad turbulence model
-    !----------------------------------------
-    if (itytur.eq.2) then
-      itypcd(ii,ik ) = 0
-      spcond(ii,ik ) = 0.d0
-      itypcd(ii,iep) = 0
-      spcond(ii,iep) = 0.d0
-    endif
-    if (nscal.gt.0) then
-      do iscal = 1, nscal
-        if (iscal.eq.iscalt) then
-
-          ! enthalpy value used for
-          ! the explicit condensation term
-          itypcd(ii,isca(iscalt)) = 1
-          spcond(ii,isca(iscalt)) = hvap
+  if (nscal.gt.0) then
+    do iscal = 1, nscal
+      ivar = isca(iscal)
+      if (iscal.eq.iscalt) then
+
+        ! enthalpy value of the vapor gas used for
+        ! the explicit condensation term
+        if (ntcabs.le.1) then
+          hvap = s_h2o_g%cp*t0
+          do ieltcd = 1, nfbpcd
+            itypcd(ieltcd,ivar) = 1
+            spcond(ieltcd,ivar) = hvap
+          enddo
         else
-
-          ! scalar values used for
-          ! the explicit condensation term
-          itypcd(ii,isca(iscal)) = 1
-          spcond(ii,isca(iscal)) = 0.d0
+          do ieltcd = 1, nfbpcd
+            iel = ifabor(ifbpcd(ieltcd))
+            itypcd(ieltcd,ivar) = 1
+            spcond(ieltcd,ivar) = s_h2o_g%cp*cvar_h(iel)/cpro_cp(iel)
+          enddo
         endif
-      enddo
-    endif
 
-  enddo
+      else
 
-  if (irangp.ge.0) then
-    call parrmx(nzones, zhext)
-    call parrmx(nzones, ztext)
-    call parrmx(nzones, zrob )
-    call parrmx(nzones, zcondb)
-    call parrmx(nzones, zcpb )
-    call parrmx(nzones, ztpar)
+        ! scalar values used for
+        ! the explicit condensation term
+        do ieltcd = 1, nfbpcd
+          itypcd(ieltcd,ivar) = 1
+          spcond(ieltcd,ivar) = 0.d0
+        enddo
+
+      endif
+    enddo
   endif
 
 endif
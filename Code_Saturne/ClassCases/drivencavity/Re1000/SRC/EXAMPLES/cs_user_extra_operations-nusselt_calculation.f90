@@ -133,6 +133,11 @@ if (ntcabs.eq.ntmabs) then
 
   iortho = 0
 
+  ! Only the values on the faces where the Nusselt number is computed
+  ! are needed: select them first, and reconstruct on those faces only.
+
+  call getfbr('normal[0,-1,0,0.1] and y < 0.01',nlelt,lstelt)
+
 !< [compute_nusselt]
   ! --> General case (for non-orthogonal meshes)
 !< [gen_nusselt]
@@ -154,7 +159,8 @@ if (ntcabs.eq.ntmabs) then
 !< [gradient_nusselt]
     ! - Compute reconstructed value in boundary cells
 !< [value_nusselt]
-    do ifac = 1, nfabor
+    do ilelt = 1, nlelt
+      ifac = lstelt(ilelt)
       iel = ifabor(ifac)
       diipbx = diipb(1,ifac)
       diipby = diipb(2,ifac)
@@ -176,7 +182,8 @@ if (ntcabs.eq.ntmabs) then
     ! Compute reconstructed value
     ! (here, we assign the non-reconstructed value)
 !< [value_ortho_nusselt]
-    do ifac = 1, nfabor
+    do ilelt = 1, nlelt
+      ifac = lstelt(ilelt)
       iel = ifabor(ifac)
       treco(ifac) = coefap(ifac) + coefbp(ifac)*cvar(iel)
     enddo
@@ -188,8 +195,6 @@ if (ntcabs.eq.ntmabs) then
     open(file="Nusselt.dat",unit=impout)
   endif
 
-  call getfbr('normal[0,-1,0,0.1] and y < 0.01',nlelt,lstelt)
-
   neltg = nlelt
   if (irangp.ge.0) then
     call parcpt(neltg)
@@ -147,6 +147,7 @@ integer          ilelt, nlelt
 integer          izone
 
 double precision alpha, cosalp, sinalp, vit, ck1, ck2
+double precision ckten(6)
 
 double precision, dimension(:,:), pointer :: cvara_vel
 
@@ -252,6 +253,10 @@ if (iappel.eq.1.or.iappel.eq.2) then
 !< [generic_subsection_1]
 !-------------------------------------------------------------------------------
 
+!< [start_3]
+elseif (iappel.eq.3) then
+!< [start_3]
+
 !=============================================================================
 
   ! Third call, at each time step
@@ -308,18 +313,27 @@ if (iappel.eq.1.or.iappel.eq.2) then
   sinalp = sin(alpha)
   ck1 = 10.d0
   ck2 =  0.d0
+
+  ! The tensor only depends on the vanes orientation, so it is built once
+  ! here; the loop below only scales it by the local velocity norm.
+  ckten(1) = cosalp**2*ck1 + sinalp**2*ck2
+  ckten(2) = sinalp**2*ck1 + cosalp**2*ck2
+  ckten(3) = 0.d0
+  ckten(4) = cosalp*sinalp*(-ck1+ck2)
+  ckten(5) = 0.d0
+  ckten(6) = 0.d0
 !< [example_4]
 
 !< [filling]
   do ielpdc = 1, ncepdp
     iel = icepdc(ielpdc)
     vit = sqrt(cvara_vel(1,iel)**2 + cvara_vel(2,iel)**2 + cvara_vel(3,iel)**2)
-    ckupdc(ielpdc,1) = (cosalp**2*ck1 + sinalp**2*ck2)*vit
-    ckupdc(ielpdc,2) = (sinalp**2*ck1 + cosalp**2*ck2)*vit
-    ckupdc(ielpdc,3) =  0.d0
-    ckupdc(ielpdc,4) = cosalp*sinalp*(-ck1+ck2)*vit
-    ckupdc(ielpdc,5) =  0.d0
-    ckupdc(ielpdc,6) =  0.d0
+    ckupdc(ielpdc,1) = ckten(1)*vit
+    ckupdc(ielpdc,2) = ckten(2)*vit
+    ckupdc(ielpdc,3) = ckten(3)*vit
+    ckupdc(ielpdc,4) = ckten(4)*vit
+    ckupdc(ielpdc,5) = ckten(5)*vit
+    ckupdc(ielpdc,6) = ckten(6)*vit
   enddo
 
   !-----------------------------------------------------------------------------
@@ -89,9 +89,13 @@ double precision dt(ncelet)
 ! Local variables
 
 !< [loc_var_dec]
-integer          iel
+integer          iel, ii, iz, iz1
 double precision d2s3
 double precision zent,xuent,xvent,xkent,xeent,tpent
+double precision az
+
+double precision, allocatable, dimension(:,:) :: dprof
+double precision, allocatable, dimension(:) :: tprof
 
 double precision, dimension(:,:), pointer :: cvar_vel
 
@@ -149,29 +153,69 @@ if (isuite.eq.0) then
     call field_get_val_s(ivarfl(inusa), cvar_nusa)
   endif
 
-  do iel = 1, ncel
+  ! The meteo profiles are first interpolated in time at their own
+  ! heights, so that only a vertical interpolation remains to be done
+  ! for each cell, with a single search of the bracketing levels for
+  ! the 4 dynamical variables.
 
-    zent = xyzcen(3,iel)
+  allocate(dprof(4,nbmetd))
 
+  do ii = 1, nbmetd
     call intprf                                                   &
     !==========
    (nbmetd, nbmetm,                                               &
-    zdmet, tmmet, umet , zent  , ttcabs, xuent )
-
+    zdmet, tmmet, umet , zdmet(ii), ttcabs, dprof(1,ii) )
     call intprf                                                   &
     !==========
    (nbmetd, nbmetm,                                               &
-    zdmet, tmmet, vmet , zent  , ttcabs, xvent )
-
+    zdmet, tmmet, vmet , zdmet(ii), ttcabs, dprof(2,ii) )
     call intprf                                                   &
     !==========
    (nbmetd, nbmetm,                                               &
-    zdmet, tmmet, ekmet, zent  , ttcabs, xkent )
-
+    zdmet, tmmet, ekmet, zdmet(ii), ttcabs, dprof(3,ii) )
     call intprf                                                   &
     !==========
    (nbmetd, nbmetm,                                               &
-    zdmet, tmmet, epmet, zent  , ttcabs, xeent )
+    zdmet, tmmet, epmet, zdmet(ii), ttcabs, dprof(4,ii) )
+  enddo
+
+  if (iscalt.ge.0) then
+    allocate(tprof(nbmett))
+    do ii = 1, nbmett
+      call intprf                                                 &
+      !==========
+   (nbmett, nbmetm,                                               &
+    ztmet, tmmet, tpmet, ztmet(ii), ttcabs, tprof(ii) )
+    enddo
+    call field_get_val_s(ivarfl(isca(iscalt)), cvar_scalt)
+  endif
+
+  do iel = 1, ncel
+
+    zent = xyzcen(3,iel)
+
+    ! Vertical interpolation (constant outside of the profile)
+    if (zent.le.zdmet(1) .or. nbmetd.eq.1) then
+      iz  = 1
+      iz1 = 1
+      az  = 0.d0
+    else if (zent.ge.zdmet(nbmetd)) then
+      iz  = nbmetd
+      iz1 = nbmetd
+      az  = 0.d0
+    else
+      iz = 1
+      do while (zdmet(iz+1).lt.zent)
+        iz = iz + 1
+      enddo
+      iz1 = iz + 1
+      az  = (zent - zdmet(iz))/(zdmet(iz1) - zdmet(iz))
+    endif
+
+    xuent = (1.d0-az)*dprof(1,iz) + az*dprof(1,iz1)
+    xvent = (1.d0-az)*dprof(2,iz) + az*dprof(2,iz1)
+    xkent = (1.d0-az)*dprof(3,iz) + az*dprof(3,iz1)
+    xeent = (1.d0-az)*dprof(4,iz) + az*dprof(4,iz1)
 
     cvar_vel(1,iel) = xuent
     cvar_vel(2,iel) = xvent
@@ -213,17 +257,27 @@ if (isuite.eq.0) then
 
     if (iscalt.ge.0) then
 ! On suppose que le scalaire est la temperature potentielle :
-      call intprf                                                 &
-      !==========
-   (nbmett, nbmetm,                                               &
-    ztmet, tmmet, tpmet, zent  , ttcabs, tpent )
+      if (zent.le.ztmet(1) .or. nbmett.eq.1) then
+        tpent = tprof(1)
+      else if (zent.ge.ztmet(nbmett)) then
+        tpent = tprof(nbmett)
+      else
+        iz = 1
+        do while (ztmet(iz+1).lt.zent)
+          iz = iz + 1
+        enddo
+        az = (zent - ztmet(iz))/(ztmet(iz+1) - ztmet(iz))
+        tpent = (1.d0-az)*tprof(iz) + az*tprof(iz+1)
+      endif
 
-      call field_get_val_s(ivarfl(isca(iscalt)), cvar_scalt)
       cvar_scalt(iel) = tpent
 
     endif
   enddo
 
+  deallocate(dprof)
+  if (allocated(tprof)) deallocate(tprof)
+
 endif
 !< [init]
 
@@ -387,10 +387,17 @@ double precision epsent(nfbent)
 
 !< [loc_var_dec3]
 integer          ii, ifac, iel
+logical          irecmp
 double precision d2s3
 double precision utau, href, reyfro, yy, yplus, uplus, kplus, eplus
 double precision uref2, xdh, xitur, xkent, xeent
 double precision, dimension(:), pointer :: cpro_viscl
+
+! Statistics cached between calls (they only depend on the geometry
+! of the inlet, on uref and on the viscosity)
+double precision, save :: urefca = -1.d0
+double precision, allocatable, dimension(:), save :: uplcac, kplcac
+double precision, allocatable, dimension(:), save :: eplcac, viscac
 !< [loc_var_dec3]
 
 !===============================================================================
@@ -411,40 +418,70 @@ if (nument.eq.1) then
   ! Reference length scale
   href = 1.d0
 
+  ! The wall-law profiles only depend on the face positions, uref and the
+  ! viscosity: they are computed on the first call (also after a restart,
+  ! as they are deterministic) and then only for faces whose viscosity
+  ! changed, or for all faces if uref changed.
+
+  irecmp = .false.
+  if (.not.allocated(uplcac)) then
+    irecmp = .true.
+  else if (size(uplcac).ne.nfbent) then
+    deallocate(uplcac, kplcac, eplcac, viscac)
+    irecmp = .true.
+  endif
+  if (irecmp) then
+    allocate(uplcac(nfbent), kplcac(nfbent), eplcac(nfbent), viscac(nfbent))
+    viscac = -1.d0
+  endif
+  if (uref.ne.urefca) then
+    irecmp = .true.
+    urefca = uref
+  endif
+
   do ii = 1, nfbent
 
     ifac = lfbent(ii)
     iel  = ifabor(ifac)
 
-    reyfro = utau*href/cpro_viscl(iel)
+    if (irecmp .or. cpro_viscl(iel).ne.viscac(ii)) then
+
+      reyfro = utau*href/cpro_viscl(iel)
+
+      ! Dimensionless wall distance
+      yy = 1.d0-abs(cdgfbo(2,ifac))
+      yplus = yy/href*reyfro
 
-    ! Dimensionless wall distance
-    yy = 1.d0-abs(cdgfbo(2,ifac))
-    yplus = yy/href*reyfro
+      ! Reichart laws (dimensionless)
+      uplus = log(1.d0+0.4d0*yplus)/xkappa                          &
+            + 7.8d0*( 1.d0 - exp(-yplus/11.d0)                      &
+                    - yplus/11.d0*exp(-0.33d0*yplus))
+      kplus = 0.07d0*yplus*yplus*exp(-yplus/8.d0)                   &
+            + (1.d0 - exp(-yplus/20.d0))*4.5d0                      &
+              / (1.d0 + 4.d0*yplus/reyfro)
+      eplus = (1.d0/xkappa)                                         &
+            / (yplus**4+15.d0**4)**(0.25d0)
 
-    ! Reichart laws (dimensionless)
-    uplus = log(1.d0+0.4d0*yplus)/xkappa                          &
-          + 7.8d0*( 1.d0 - exp(-yplus/11.d0)                      &
-                  - yplus/11.d0*exp(-0.33d0*yplus))
-    kplus = 0.07d0*yplus*yplus*exp(-yplus/8.d0)                   &
-          + (1.d0 - exp(-yplus/20.d0))*4.5d0                      &
-            / (1.d0 + 4.d0*yplus/reyfro)
-    eplus = (1.d0/xkappa)                                         &
-          / (yplus**4+15.d0**4)**(0.25d0)
+      uplcac(ii) = uplus
+      kplcac(ii) = kplus
+      eplcac(ii) = eplus
+      viscac(ii) = cpro_viscl(iel)
+
+    endif
 
     ! Arrays are filled with dimensionnal stats
-    uvwent(1,ii) = uplus*utau
+    uvwent(1,ii) = uplcac(ii)*utau
     uvwent(2,ii) = 0.d0
     uvwent(3,ii) = 0.d0
 
-    rijent(1,ii) = d2s3*kplus*utau**2
-    rijent(2,ii) = d2s3*kplus*utau**2
-    rijent(3,ii) = d2s3*kplus*utau**2
+    rijent(1,ii) = d2s3*kplcac(ii)*utau**2
+    rijent(2,ii) = d2s3*kplcac(ii)*utau**2
+    rijent(3,ii) = d2s3*kplcac(ii)*utau**2
     rijent(4,ii) = 0.d0
     rijent(5,ii) = 0.d0
     rijent(6,ii) = 0.d0
 
-    epsent(ii) = eplus*utau**4/cpro_viscl(iel)
+    epsent(ii) = eplcac(ii)*utau**4/viscac(ii)
 
   enddo
 
@@ -467,32 +504,31 @@ endif
 !< [example_2]
 if (nument.eq.1) then
 
-  do ii = 1, nfbent
+  ! The mean velocity is uniform over the inlet, so the k and epsilon
+  ! given by the pipe correlation are the same for all faces and are
+  ! computed once.
 
-    ifac = lfbent(ii)
-    iel  = ifabor(ifac)
+  uref2 = 3.d0*1.1d0**2
+  uref2 = max(uref2,1.d-12)
 
-    uvwent(1,ii) = 1.1d0
-    uvwent(2,ii) = 1.1d0
-    uvwent(3,ii) = 1.1d0
+  ! Hydraulic diameter
+  xdh = 0.075d0
 
-    uref2 = uvwent(1,ii)**2   &
-          + uvwent(2,ii)**2   &
-          + uvwent(3,ii)**2
-    uref2 = max(uref2,1.d-12)
+  ! Turbulence intensity
+  xitur = 0.02d0
 
-    ! Hydraulic diameter
-    xdh = 0.075d0
+  xkent = epzero
+  xeent = epzero
 
-    ! Turbulence intensity
-    xitur = 0.02d0
+  call keenin &
+  !==========
+( uref2, xitur, xdh, cmu, xkappa, xkent, xeent )
 
-    xkent = epzero
-    xeent = epzero
+  do ii = 1, nfbent
 
-    call keenin &
-    !==========
-  ( uref2, xitur, xdh, cmu, xkappa, xkent, xeent )
+    uvwent(1,ii) = 1.1d0
+    uvwent(2,ii) = 1.1d0
+    uvwent(3,ii) = 1.1d0
 
     rijent(1,ii) = d2s3*xkent
     rijent(2,ii) = d2s3*xkent
@@ -98,7 +98,7 @@ double precision smacel(ncesmp,nvar)
 ! Local variables
 
 integer          ieltsm
-integer          ifac, ii
+integer          ifac, ii, ivar
 integer          ilelt, nlelt
 integer          izone
 
@@ -108,6 +108,8 @@ double precision xkent, xeent
 double precision flucel
 double precision vtot  , gamma
 
+double precision, save :: vtotcac = -1.d0
+
 integer, allocatable, dimension(:) :: lstelt
 !< [loc_var]
 
@@ -196,9 +198,9 @@ if (iappel.eq.1.or.iappel.eq.2) then
     ifac = lstelt(ilelt)
     ii   = ifabor(ifac)
     ! The cells that have already been counted above are not
-    ! counted again.
-    if (.not.(xyzcen(1,ii).lt.500.d0.and.                     &
-         xyzcen(1,ii).gt.250.d0)    )then
+    ! counted again (same criterion as in the getcel call).
+    if (.not.(xyzcen(1,ii).lt.5.0d0.and.                      &
+         xyzcen(1,ii).gt.2.5d0)    )then
       ieltsm = ieltsm + 1
       izctsm(ii) = izone
       if (iappel.eq.2) icetsm(ieltsm) = ii
@@ -265,51 +267,80 @@ elseif (iappel.eq.3) then
   flucel = 0.d0
   do ieltsm = 1, ncesmp
     smacel(ieltsm,ipr) = 30000.d0
+    flucel = flucel+                                            &
+         volume(icetsm(ieltsm))*smacel(ieltsm,ipr)
+  enddo
+
+  do ieltsm = 1, ncesmp
     itypsm(ieltsm,iv) = 1
     smacel(ieltsm,iv) = wind
-    if (itytur.eq.2) then
+  enddo
+
+  if (itytur.eq.2 .or. iturb.eq.50) then
+    do ieltsm = 1, ncesmp
       itypsm(ieltsm,ik) = 1
       smacel(ieltsm,ik) = xkent
+    enddo
+    do ieltsm = 1, ncesmp
       itypsm(ieltsm,iep) = 1
       smacel(ieltsm,iep) = xeent
-    else if (itytur.eq.3) then
+    enddo
+    if (iturb.eq.50) then
+      do ieltsm = 1, ncesmp
+        itypsm(ieltsm,iphi) = 1
+        smacel(ieltsm,iphi) = 2.d0/3.d0
+      enddo
+      ! There is no mass source term in the equation for f_bar
+    endif
+  else if (itytur.eq.3) then
+    do ieltsm = 1, ncesmp
       itypsm(ieltsm,ir11) = 1
-      itypsm(ieltsm,ir12) = 1
-      itypsm(ieltsm,ir13) = 1
+      smacel(ieltsm,ir11) = 2.d0/3.d0*xkent
+    enddo
+    do ieltsm = 1, ncesmp
       itypsm(ieltsm,ir22) = 1
-      itypsm(ieltsm,ir23) = 1
+      smacel(ieltsm,ir22) = 2.d0/3.d0*xkent
+    enddo
+    do ieltsm = 1, ncesmp
       itypsm(ieltsm,ir33) = 1
-      smacel(ieltsm,ir11) = 2.d0/3.d0*xkent
+      smacel(ieltsm,ir33) = 2.d0/3.d0*xkent
+    enddo
+    do ieltsm = 1, ncesmp
+      itypsm(ieltsm,ir12) = 1
       smacel(ieltsm,ir12) = 0.d0
+    enddo
+    do ieltsm = 1, ncesmp
+      itypsm(ieltsm,ir13) = 1
       smacel(ieltsm,ir13) = 0.d0
-      smacel(ieltsm,ir22) = 2.d0/3.d0*xkent
+    enddo
+    do ieltsm = 1, ncesmp
+      itypsm(ieltsm,ir23) = 1
       smacel(ieltsm,ir23) = 0.d0
-      smacel(ieltsm,ir33) = 2.d0/3.d0*xkent
-      itypsm(ieltsm,iep) = 1
-      smacel(ieltsm,iep) = xeent
-    else if (iturb.eq.50) then
-      itypsm(ieltsm,ik) = 1
-      smacel(ieltsm,ik) = xkent
+    enddo
+    do ieltsm = 1, ncesmp
       itypsm(ieltsm,iep) = 1
       smacel(ieltsm,iep) = xeent
-      itypsm(ieltsm,iphi) = 1
-      smacel(ieltsm,iphi) = 2.d0/3.d0
-      ! There is no mass source term in the equation for f_bar
-    else if (iturb.eq.60) then
+    enddo
+  else if (iturb.eq.60) then
+    do ieltsm = 1, ncesmp
       itypsm(ieltsm,ik) = 1
       smacel(ieltsm,ik) = xkent
+    enddo
+    do ieltsm = 1, ncesmp
       itypsm(ieltsm,iomg)= 1
       smacel(ieltsm,iomg)= xeent/cmu/xkent
-    endif
-    if (nscal.gt.0) then
-      do ii = 1, nscal
-        itypsm(ieltsm,isca(ii)) = 1
-        smacel(ieltsm,isca(ii)) = 1.d0
+    enddo
+  endif
+
+  if (nscal.gt.0) then
+    do ii = 1, nscal
+      ivar = isca(ii)
+      do ieltsm = 1, ncesmp
+        itypsm(ieltsm,ivar) = 1
+        smacel(ieltsm,ivar) = 1.d0
       enddo
-    endif
-    flucel = flucel+                                            &
-         volume(icetsm(ieltsm))*smacel(ieltsm,ipr)
-  enddo
+    enddo
+  endif
 
   if (irangp.ge.0) then
     call parsom (flucel)
@@ -330,15 +361,20 @@ elseif (iappel.eq.3) then
   ! Calculation of the total volume of the area where the mass source
   !   term is imposed (the case of parallel computing is taken into
   !   account with the call to parsom).
+  ! The source cells being defined once and for all at the first calls,
+  !   this volume is computed only once, unless the mesh moves (ALE).
 
 !< [calcul_total]
-  vtot = 0.d0
-  do ieltsm = 1, ncesmp
-    vtot = vtot + volume(icetsm(ieltsm))
-  enddo
-  if (irangp.ge.0) then
-    call parsom (vtot)
+  if (vtotcac.lt.0.d0 .or. iale.ge.1) then
+    vtotcac = 0.d0
+    do ieltsm = 1, ncesmp
+      vtotcac = vtotcac + volume(icetsm(ieltsm))
+    enddo
+    if (irangp.ge.0) then
+      call parsom (vtotcac)
+    endif
   endif
+  vtot = vtotcac
 !< [calcul_total]
 
   ! The mass suction rate is gamma = -80000/vtot (in kg/m3/s)
@@ -70,11 +70,11 @@ double precision tmet
 
 integer          icmst
 integer          ifac, iel, iscal
-integer          ivarh
+integer          ivar, ivarh
 integer          izone
 integer          f_id
 
-double precision hvap, tk
+double precision hvap
 
 type(gas_mix_species_prop) s_h2o_g
 
@@ -187,40 +187,45 @@ call field_get_val_s(ivarfl(ivarh), cvar_h)
 ! if we want to specify a variable value
 !---------------------------------------
 
-do icmst = 1, ncmast
-  iel = ltmast(icmst)
-
-  ! Compute the enthalpy value of vapor gas
-  if (ntcabs.le.1) then
-    tk = t0
-  else
-    tk = cvar_h(iel)/cpro_cp(iel)
-  endif
-  hvap = s_h2o_g%cp*tk
-
-  ! Condensation source terms associated
-  ! to the metal structures imposed
-  ! for each scalar.
-  !----------------------------------------
-  if (nscal.gt.0) then
-    do iscal = 1, nscal
-      if (iscal.eq.iscalt) then
-
-        ! enthalpy value used for
-        ! the explicit condensation term
-        itypst(iel,isca(iscalt)) = 1
-        svcond(iel,isca(iscalt)) = hvap
+! Condensation source terms associated
+! to the metal structures imposed
+! for each scalar.
+!----------------------------------------
+if (nscal.gt.0) then
+  do iscal = 1, nscal
+    ivar = isca(iscal)
+    if (iscal.eq.iscalt) then
+
+      ! enthalpy value of the vapor gas used for
+      ! the explicit condensation term
+      if (ntcabs.le.1) then
+        hvap = s_h2o_g%cp*t0
+        do icmst = 1, ncmast
+          iel = ltmast(icmst)
+          itypst(iel,ivar) = 1
+          svcond(iel,ivar) = hvap
+        enddo
       else
-
-        ! scalar values used for
-        ! the explicit condensation term
-        itypst(iel,isca(iscal)) = 1
-        svcond(iel,isca(iscal)) = 0.d0
+        do icmst = 1, ncmast
+          iel = ltmast(icmst)
+          itypst(iel,ivar) = 1
+          svcond(iel,ivar) = s_h2o_g%cp*cvar_h(iel)/cpro_cp(iel)
+        enddo
       endif
-    enddo
-  endif
 
-enddo
+    else
+
+      ! scalar values used for
+      ! the explicit condensation term
+      do icmst = 1, ncmast
+        iel = ltmast(icmst)
+        itypst(iel,ivar) = 1
+        svcond(iel,ivar) = 0.d0
+      enddo
+
+    endif
+  enddo
+endif
 
 !--------
 ! Formats
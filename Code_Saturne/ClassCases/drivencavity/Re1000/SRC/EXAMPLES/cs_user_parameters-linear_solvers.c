@@ -390,6 +390,31 @@ cs_user_linear_solvers(void)
 
   END_EXAMPLE_SCOPE
 
+  /* Example: use multigrid for the electric potentials */
+  /*----------------------------------------------------*/
+
+  /* With the electric arcs or Joule effect models, the real and imaginary
+     potentials and the components of the vector potential are solved at
+     each time step. They are all conductivity-weighted diffusion systems,
+     for which multigrid usually converges much faster than the default
+     conjugate gradient. */
+
+  BEGIN_EXAMPLE_SCOPE
+
+  /*! [sles_elec_pot] */
+  const char *pot_names[] = {"elec_pot_r", "elec_pot_i",
+                             "vec_potential_01", "vec_potential_02",
+                             "vec_potential_03"};
+
+  for (int i = 0; i < 5; i++) {
+    cs_field_t *f = cs_field_by_name_try(pot_names[i]);
+    if (f != NULL)
+      cs_multigrid_define(f->id, NULL);
+  }
+  /*! [sles_elec_pot] */
+
+  END_EXAMPLE_SCOPE
+
   /* Set a non-default linear solver for DOM radiation. */
   /*----------------------------------------------------*/
 
@@ -101,7 +101,7 @@ double precision visco_SO2, visco_NH3, visco_CO2
 
 character*80     fname
 
-double precision, allocatable, dimension(:) :: visco
+double precision, allocatable, dimension(:) :: visco, taufac
 
 double precision, dimension(:), pointer :: cpro_rom1, cpro_rom2, cpro_diam2
 double precision, dimension(:), pointer :: cpro_temp1, cpro_x2, cpro_x1
@@ -119,7 +119,7 @@ double precision, dimension(:), pointer :: cpro_taupg
 !===============================================================================
 
 !< [init]
-allocate(visco(ncelet))
+allocate(visco(ncelet), taufac(ncelet))
 
 call field_get_val_s(iprpfl(iym1(3)), cpro_ym1_3)
 call field_get_val_s(iprpfl(iym1(5)), cpro_ym1_5)
@@ -250,6 +250,12 @@ endif
 ! get x1 = 1 - sum cpro_x2
 call field_get_val_s_by_name("x_c", cpro_x1)
 
+! Part of the relaxation time common to all the particle classes,
+! so that the class loops below only do products
+do iel = 1, ncel
+  taufac(iel) = cpro_x1(iel) / (18.d0*visco(iel))
+enddo
+
 ! All gas scalars have the same drift as if1m(1)
 !-----------------------------------------------
 
@@ -312,23 +318,16 @@ do iflid = 0, nfld-1
 
     ! Computation of the relaxation time of the particles
     ! the drift is therefore v_g = tau_p * g
+    ! and of its contribution to the drift for the gas:
+    ! tau_pg = - Sum_i X2_i v_gi
     !----------------------------------------------------
 
     do iel = 1, ncel
 
       ! Simple model for Low Reynolds Numbers
-      cpro_taup(iel) = cpro_x1(iel) * cpro_rom2(iel)                &
-                     * cpro_diam2(iel)**2                           &
-                     / (18.d0*visco(iel))
-
-    enddo
-
-    ! Drift for the gas:
-    ! tau_pg = - Sum_i X2_i v_gi
-    do iel = 1, ncel
+      cpro_taup(iel) = cpro_rom2(iel) * cpro_diam2(iel)**2 * taufac(iel)
 
-      cpro_taupg(iel) = cpro_taupg(iel)                                  &
-                      - ( cpro_taup(iel) * cpro_x2(iel) )
+      cpro_taupg(iel) = cpro_taupg(iel) - cpro_taup(iel) * cpro_x2(iel)
 
     enddo
 
@@ -339,7 +338,7 @@ enddo ! loop on iflid
 !< [example_1]
 
 !Free memory
-deallocate(visco)
+deallocate(visco, taufac)
 
 !===============================================================================
 
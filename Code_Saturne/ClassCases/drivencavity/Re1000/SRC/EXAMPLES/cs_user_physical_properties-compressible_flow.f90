@@ -106,6 +106,7 @@ subroutine usphyv &
 !===============================================================================
 
 use paramx
+use cstnum
 use pointe
 use numvar
 use optcal
@@ -142,6 +143,14 @@ double precision varal, varbl, varcl, vardl
 double precision varac, varbc
 double precision xvart
 
+integer          itab, ntab, nfine, iprop
+integer          ntabmx
+double precision tabtol, tabeps, tabtmn, tabtmx
+double precision dtab, wtab, xint, errtab
+double precision pscal(3)
+double precision, save :: tbmin = 0.d0, tbmax = -1.d0, rdtab = 0.d0
+double precision, allocatable, dimension(:,:), save :: proptb
+
 double precision, dimension(:), pointer :: cpro_viscl, cpro_viscv
 double precision, dimension(:), pointer :: cpro_vtmpk, cpro_vscal
 double precision, dimension(:), pointer :: cpro_cp, cpro_cv, mix_mol_mas
@@ -170,6 +179,7 @@ double precision, dimension(:), pointer :: cvar_scalt
 ! Ex. 3: isobaric specific heat varying with temperature
 ! Ex. 4: molecular thermal conductivity varying with temperature
 ! Ex. 5: molecular diffusivity of user-defined scalars varying with temperature
+! Ex. 6: tabulated viscosities and thermal conductivity
 
 !===============================================================================
 
@@ -452,6 +462,146 @@ enddo
 ! --- End of the loop on the scalars
 !< [example_5]
 
+!===============================================================================
+! Ex. 6: tabulated viscosities and thermal conductivity
+! =====
+!    When the property laws are expensive (real gas correlations, mixture
+!    rules...), they may be evaluated on a temperature table instead of at
+!    each cell. The table is shared by all the tabulated properties, so that
+!    a single lookup per cell is needed. It is built once, on a temperature
+!    range [tabtmn, tabtmx] provided by the user; cells outside of this
+!    range use the laws directly. Its step is refined until the linear
+!    interpolation error is below tabtol, relative to each property value
+!    (plus a fraction tabeps of its maximum, for laws crossing zero).
+!
+!    This example sets the same properties as examples 1, 2 and 4, with the
+!    same laws, and is meant to replace them, not to be used with them (it
+!    overwrites their results). These cubic laws are cheaper than the table
+!    lookup itself: they only stand for the expensive laws for which
+!    tabulation pays off.
+!===============================================================================
+
+!< [example_6]
+ivart = isca(itempk)
+call field_get_val_s(ivarfl(ivart), cvar_scalt)
+
+! --- Tabulated properties
+
+call field_get_val_s(iprpfl(iviscl), cpro_viscl)
+
+if (iviscv.le.0) then
+  write(nfecra,2000) iviscv
+  call csexit (1)
+endif
+call field_get_val_s(iprpfl(iviscv), cpro_viscv)
+
+call field_get_key_int(ivarfl(isca(itempk)), kivisl, ifcvsl)
+if (ifcvsl.lt.0) then
+  write(nfecra,1010) itempk
+  call csexit (1)
+endif
+call field_get_val_s(ifcvsl, cpro_vtmpk)
+
+! --- Temperature range, accuracy and maximum number of points of the table
+
+tabtmn = 200.d0
+tabtmx = 3000.d0
+tabtol = 1.d-6
+tabeps = 1.d-3
+ntabmx = 65537
+
+! --- User-defined coefficients of the laws (examples 1, 2 and 4)
+
+varam = -3.4016d-9
+varbm =  6.2332d-7
+varcm = -4.5577d-5
+vardm =  1.6935d-3
+
+varal = -3.3283d-7
+varbl =  3.6021d-5
+varcl =  1.2527d-4
+vardl =  0.58923d0
+
+! --- Build the table at the first call. Its range being set by the user,
+!     it is the same on all ranks and no parallel operation is needed.
+
+if (.not.allocated(proptb)) then
+
+  tbmin = tabtmn
+  tbmax = tabtmx
+
+  ! Each pass doubles the number of intervals and compares the values
+  ! at the new points with the interpolation from the previous table;
+  ! the resulting table is then about 4 times more accurate than tabtol.
+
+  ntab = 17
+  do
+
+    nfine = 2*ntab - 1
+    if (allocated(proptb)) deallocate(proptb)
+    allocate(proptb(3,nfine))
+
+    dtab = (tbmax - tbmin)/dble(nfine - 1)
+
+    do itab = 1, nfine
+      xvart = tbmin + dble(itab - 1)*dtab
+      ! molecular viscosity (Ex. 1)
+      proptb(1,itab) = xvart*(xvart*(varam*xvart+varbm)+varcm)+vardm
+      ! molecular volumetric viscosity (Ex. 2)
+      proptb(2,itab) = xvart*(xvart*(varam*xvart+varbm)+varcm)+vardm
+      ! molecular thermal conductivity (Ex. 4)
+      proptb(3,itab) = xvart*(xvart*(varal*xvart+varbl)+varcl)+vardl
+    enddo
+
+    do iprop = 1, 3
+      pscal(iprop) = 0.d0
+      do itab = 1, nfine
+        pscal(iprop) = max(pscal(iprop), abs(proptb(iprop,itab)))
+      enddo
+    enddo
+
+    errtab = 0.d0
+    do itab = 2, nfine-1, 2
+      do iprop = 1, 3
+        xint = 0.5d0*(proptb(iprop,itab-1) + proptb(iprop,itab+1))
+        errtab = max(errtab, abs(xint - proptb(iprop,itab))                &
+                            /max(abs(proptb(iprop,itab))                   &
+                                 + tabeps*pscal(iprop), epzero))
+      enddo
+    enddo
+
+    ntab = nfine
+    if (errtab.le.tabtol .or. ntab.ge.ntabmx) exit
+
+  enddo
+
+  rdtab = 1.d0/dtab
+
+endif
+
+! --- Linear interpolation in the table, shared by the 3 properties,
+!     or direct evaluation outside of its range
+
+ntab = size(proptb, 2)
+
+do iel = 1, ncel
+  xvart = cvar_scalt(iel)
+  if (xvart.ge.tbmin .and. xvart.le.tbmax) then
+    wtab = (xvart - tbmin)*rdtab
+    itab = min(int(wtab), ntab - 2)
+    wtab = wtab - dble(itab)
+    itab = itab + 1
+    cpro_viscl(iel) = (1.d0-wtab)*proptb(1,itab) + wtab*proptb(1,itab+1)
+    cpro_viscv(iel) = (1.d0-wtab)*proptb(2,itab) + wtab*proptb(2,itab+1)
+    cpro_vtmpk(iel) = (1.d0-wtab)*proptb(3,itab) + wtab*proptb(3,itab+1)
+  else
+    cpro_viscl(iel) = xvart*(xvart*(varam*xvart+varbm)+varcm)+vardm
+    cpro_viscv(iel) = xvart*(xvart*(varam*xvart+varbm)+varcm)+vardm
+    cpro_vtmpk(iel) = xvart*(xvart*(varal*xvart+varbl)+varcl)+vardl
+  endif
+enddo
+!< [example_6]
+
 !--------
 ! Formats
 !--------
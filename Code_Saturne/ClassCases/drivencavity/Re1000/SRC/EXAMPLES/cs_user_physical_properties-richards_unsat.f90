@@ -117,6 +117,10 @@ endif
 !===============================================================================
 ! Example of the definition of the physical properties of a single variably saturated soil
 !===============================================================================
+! All the properties of the flow and transport parts are computed in a single
+! loop on cells, so that the pressure head, saturation and velocity of a cell
+! are loaded only once.
+
 ! Flow part
 !==========
 
@@ -140,6 +144,29 @@ l_param = 0.5d0
 alpha_param = 0.036d0
 !< [richards_set_genuch]
 
+! Transport part for one solute with anisotropic dispersion and sorption
+!=======================================================================
+
+!< [richards_unsat_trpt_init]
+! Set values of the longitudinal and transversal dirpersivity
+darcy_anisotropic_dispersion_l = 2.d0
+darcy_anisotropic_dispersion_t = 1.d-1
+tmp_lt = darcy_anisotropic_dispersion_l-darcy_anisotropic_dispersion_t
+
+! Set value of the molecular diffusion
+molecular_diffusion = 1.d-3
+
+! Set values of the sorption (K_d hypothesis)
+rho = 1.5d0
+Kd  = 1.d-1
+!< [richards_unsat_trpt_init]
+
+if (ifcvsl.ge.0) then
+  call field_get_val_s(ifcvsl, cpro_vscalt)
+else
+  cpro_vscalt => NULL()
+endif
+
 ! Loop on all cell
 do iel = 1, ncel
 
@@ -193,60 +220,32 @@ do iel = 1, ncel
   endif
   !< [richards_unsat_part]
 
-enddo
-
-!===============================================================================
-! Transport part for one solute with anisotropic dispersion and sorption
-!===============================================================================
-
-!< [richards_unsat_trpt_init]
-! Set values of the longitudinal and transversal dirpersivity
-darcy_anisotropic_dispersion_l = 2.d0
-darcy_anisotropic_dispersion_t = 1.d-1
-
-! Set value of the molecular diffusion
-molecular_diffusion = 1.d-3
-!< [richards_unsat_trpt_init]
-
-!< [richards_unsat_mol_diff]
-! Computation of molecular diffusion of the diffusion term
-if (ifcvsl.ge.0) then
-  call field_get_val_s(ifcvsl, cpro_vscalt)
-  do iel = 1, ncel
+  !< [richards_unsat_mol_diff]
+  ! Computation of molecular diffusion of the diffusion term
+  if (ifcvsl.ge.0) then
     cpro_vscalt(iel) = saturation(iel)*molecular_diffusion
-  enddo
-else
-  cpro_vscalt => NULL()
-endif
-!< [richards_unsat_mol_diff]
-
-!< [richards_unsat_aniso_disp]
-! Computation of the isotropic dispersivity
-do iel = 1, ncel
+  endif
+  !< [richards_unsat_mol_diff]
 
+  !< [richards_unsat_aniso_disp]
   ! Computation of the norm of the velocity
   velocity_norm = sqrt(vel(1,iel)**2+vel(2,iel)**2+vel(3,iel)**2)
 
   ! Tensorial dispersion is stored in visten
-  tmp_lt = darcy_anisotropic_dispersion_l-darcy_anisotropic_dispersion_t
   visten(1,iel) = darcy_anisotropic_dispersion_t*velocity_norm + tmp_lt*vel(1,iel)**2/(velocity_norm+1.d-15)
   visten(2,iel) = darcy_anisotropic_dispersion_t*velocity_norm + tmp_lt*vel(2,iel)**2/(velocity_norm+1.d-15)
   visten(3,iel) = darcy_anisotropic_dispersion_t*velocity_norm + tmp_lt*vel(3,iel)**2/(velocity_norm+1.d-15)
   visten(4,iel) = tmp_lt*vel(2,iel)*vel(1,iel)/(velocity_norm+1.d-15)
   visten(5,iel) = tmp_lt*vel(2,iel)*vel(3,iel)/(velocity_norm+1.d-15)
   visten(6,iel) = tmp_lt*vel(3,iel)*vel(1,iel)/(velocity_norm+1.d-15)
+  !< [richards_unsat_aniso_disp]
 
-enddo
-!< [richards_unsat_aniso_disp]
-
-!< [richards_unsat_sorp]
-! Computation of the sorption as a delay term (K_d hypothesis)
-rho = 1.5d0
-Kd  = 1.d-1
-do iel = 1, ncel
+  !< [richards_unsat_sorp]
+  ! Computation of the sorption as a delay term (K_d hypothesis)
   delay(iel) = 1.d0+rho*Kd/saturation(iel)
+  !< [richards_unsat_sorp]
+
 enddo
-!< [richards_unsat_sorp]
 
 deallocate(delay_id)
 
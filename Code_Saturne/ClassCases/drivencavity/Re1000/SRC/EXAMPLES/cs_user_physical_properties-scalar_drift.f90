@@ -87,6 +87,7 @@ integer          iscal, iflid, iscdri, ifcvsl
 integer          f_id, keydri, nfld, keysca
 double precision rho, viscl
 double precision diamp, rhop, cuning
+double precision ctaup, cvscal
 double precision xvart, xk, xeps, beta1
 
 character*80     fname
@@ -170,12 +171,13 @@ do iflid = 0, nfld-1
 
     ! --- Scalar's diffusivity (Brownian motion)
 
+    ! --- Stop if the diffusivity is not variable
     call field_get_key_int(ivarfl(isca(iscal)), kivisl, ifcvsl)
-    if (ifcvsl.ge.0) then
-      call field_get_val_s(ifcvsl, cpro_vscal)
-    else
-      cpro_vscal => NULL()
+    if (ifcvsl.lt.0) then
+      write(nfecra,1010) iscal
+      call csexit (1)
     endif
+    call field_get_val_s(ifcvsl, cpro_vscal)
 
     ! --- Coefficients of drift scalar CHOSEN BY THE USER
     !       Values given here are fictitious
@@ -201,19 +203,30 @@ do iflid = 0, nfld-1
     endif
 
     ! Computation of the relaxation time of the particles
+    ! and of the Brownian diffusion at cell centers
     !----------------------------------------------------
 
+    ! Both are inversely proportional to the molecular viscosity,
+    ! so they are computed in the same loop on cells.
+
     if (diamp.le.1.d-6) then
       ! Cuningham's correction for submicronic particules
-      do iel = 1, ncel
-        cpro_taup(iel) = cuning*diamp**2*rhop/(18.d0*cpro_viscl(iel))
-      enddo
+      ctaup = cuning*diamp**2*rhop/18.d0
     else
-      do iel = 1, ncel
-        cpro_taup(iel) = diamp**2*rhop/(18.d0*cpro_viscl(iel))
-      enddo
+      ctaup = diamp**2*rhop/18.d0
     endif
 
+    ! Brownian diffusion homogeneous to a dynamic viscosity
+    cvscal = kboltz*cuning/(3.d0*pi*diamp)
+
+    do iel = 1, ncel
+      xvart = cvar_scalt(iel)
+      rho = cpro_rom(iel)
+      viscl = cpro_viscl(iel)
+      cpro_taup(iel) = ctaup/viscl
+      cpro_vscal(iel) = rho*xvart*cvscal/viscl
+    enddo
+
     ! Compute the interaction time particle--eddies (tau_fpt)
     !--------------------------------------------------------
 
@@ -257,24 +270,6 @@ do iflid = 0, nfld-1
 
     endif
 
-    ! Brownian diffusion at cell centers
-    !-----------------------------------
-
-    ! --- Stop if the diffusivity is not variable
-    call field_get_key_int(ivarfl(isca(iscal)), kivisl, ifcvsl)
-    if (ifcvsl.lt.0) then
-      write(nfecra,1010) iscal
-      call csexit (1)
-    endif
-
-    ! Homogeneous to a dynamic viscosity
-    do iel = 1, ncel
-      xvart = cvar_scalt(iel)
-      rho = cpro_rom(iel)
-      viscl = cpro_viscl(iel)
-      cpro_vscal(iel) = rho*kboltz*xvart*cuning/(3.d0*pi*diamp*viscl)
-    enddo
-
   endif ! --- Tests on drift scalar
 enddo
 !< [example_1]
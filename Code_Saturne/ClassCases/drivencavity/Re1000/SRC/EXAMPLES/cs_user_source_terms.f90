@@ -208,9 +208,6 @@ qdm  = 100.d0
 
 do iel = 1, ncel
   crvimp(1, 1, iel) = - cell_f_vol(iel)*cpro_rom(iel)*ckp
-enddo
-
-do iel = 1, ncel
   crvexp(1, iel) = cell_f_vol(iel)*qdm
 enddo
 
@@ -397,6 +394,9 @@ double precision tauf, prodf, voltf, pwatt
 integer, allocatable, dimension(:) :: lstelt
 double precision, dimension(:), pointer ::  cpro_rom
 
+double precision, save :: voltfc = -1.d0
+integer, allocatable, dimension(:), save :: lstvol
+
 !< [loc_var_dec_2]
 
 !===============================================================================
@@ -482,9 +482,6 @@ if (iscal.eq.2) then
 
    do iel = 1, ncel
       crvimp(iel) = - cell_f_vol(iel)*cpro_rom(iel)/tauf
-   enddo
-
-   do iel = 1, ncel
       crvexp(iel) =   cell_f_vol(iel)*cpro_rom(iel)*prodf
    enddo
 
@@ -520,24 +517,41 @@ pwatt = 100.d0
 
 ! calculation of voltf
 
+! The selected cells and their volume do not change during the
+! calculation on a fixed mesh: they are computed at the first call only,
+! and shared by all the scalars calling this routine. With ALE, cells move
+! and their volumes change, so they are recomputed at each call.
+
 !< [ex_3_compute_voltf]
-voltf  = 0.d0
-call getcel('x > 0.0 and x < 1.2 and y > 3.1 and '//               &
-            'y < 4.0', nlelt, lstelt)
+if (iale.ge.1 .and. allocated(lstvol)) deallocate(lstvol)
 
-do ilelt = 1, nlelt
-  iel = lstelt(ilelt)
-  voltf = voltf + cell_f_vol(iel)
-enddo
+if (.not.allocated(lstvol)) then
+
+  call getcel('x > 0.0 and x < 1.2 and y > 3.1 and '//             &
+              'y < 4.0', nlelt, lstelt)
+
+  allocate(lstvol(nlelt))
+
+  voltfc = 0.d0
+  do ilelt = 1, nlelt
+    iel = lstelt(ilelt)
+    lstvol(ilelt) = iel
+    voltfc = voltfc + cell_f_vol(iel)
+  enddo
+
+  if (irangp.ge.0) then
+    call parsom(voltfc)
+  endif
 
-if (irangp.ge.0) then
-  call parsom(voltf)
 endif
+
+nlelt = size(lstvol)
+voltf = voltfc
 !< [ex_3_compute_voltf]
 
 !< [ex_3_apply]
 do ilelt = 1, nlelt
-  iel = lstelt(ilelt)
+  iel = lstvol(ilelt)
 ! No implicit source term
   crvimp(iel) = 0.d0
 ! Explicit source term
@@ -758,14 +772,11 @@ if (.false.) then
     ff  = 3.d0
     tau = 4.d0
 
-    ! --- Explicit source terms
+    ! --- Explicit and implicit source terms
+    !        crvimp is already initialized to 0, no need to set it
+    !        where it is not used
     do iel = 1, ncel
       crvexp(iel) = -cpro_rom(iel)*cell_f_vol(iel)*ff
-    enddo
-
-    ! --- Implicit source terms
-    !        crvimp is already initialized to 0, no need to set it here
-    do iel = 1, ncel
       crvimp(iel) = -cpro_rom(iel)*cell_f_vol(iel)/tau
     enddo
 